@@ -0,0 +1,75 @@
+#!/usr/bin/env python
+
+'''
+Reader for the data files of the turboPerformance, forces and fluidPower
+functionObjects (turboDataFile), in ascii or binary format, gzip compressed
+or not.
+Usage: Place the program in your ~HOME/bin directory and make it executable.
+As a module:
+    from readTurboData import readTurboData
+    columns, data = readTurboData('turboPerformance/0/turboPerformance.dat')
+    time = data[:,0]
+From the command line, print a file as tab separated ascii columns:
+readTurboData.py  turboPerformance/0/turboPerformance.dat[.gz]
+'''
+
+import sys
+import gzip
+import numpy as np
+
+# - - - Function definitions - - - -
+
+def openTurboData( fileName ):
+    if( fileName.endswith('.gz') ):
+        return gzip.open( fileName, 'rb' )
+    return open( fileName, 'rb' )
+
+# - - - - - - - - - - - - - - -
+
+def readTurboData( fileName ):
+    f = openTurboData( fileName )
+    firstLine = f.readline().decode('ascii').strip()
+
+    if( firstLine != '# turboDataFile' ):
+        # ascii file: one header line with the tab separated column names
+        columns = firstLine.lstrip('#').split()
+        data = np.loadtxt( f, ndmin=2 )
+        f.close()
+        return columns, data
+
+    # binary file: self-describing header, then fixed-width records
+    header = {}
+    while True:
+        line = f.readline().decode('ascii').strip()
+        if( line == '' ):
+            raise IOError('Truncated header in file '+fileName)
+        if( line == '# data' ):
+            break
+        words = line.lstrip('#').split()
+        header[words[0]] = words[1:]
+
+    nColumns = int(header['nColumns'][0])
+    byteOrder = {'little': '<', 'big': '>'}[header['byteOrder'][0]]
+    scalarType = {'4': 'f4', '8': 'f8'}[header['scalarSize'][0]]
+
+    raw = f.read()
+    f.close()
+
+    # Ignore a last record truncated by a crash
+    dtype = np.dtype(byteOrder+scalarType)
+    nRecords = len(raw)//(dtype.itemsize*nColumns)
+    data = np.frombuffer( raw[:nRecords*dtype.itemsize*nColumns], dtype=dtype )
+
+    return header['columns'], data.reshape( nRecords, nColumns )
+
+# - - - Main program - - - - -
+
+if __name__ == '__main__':
+    if( len(sys.argv) != 2 ):
+        sys.stderr.write(__doc__)
+        sys.exit(1)
+
+    columns, data = readTurboData( sys.argv[1] )
+
+    sys.stdout.write( '# '+'\t'.join(columns)+'\n' )
+    np.savetxt( sys.stdout, data, delimiter='\t', fmt='%.6g' )